@@ -475,7 +475,7 @@ int dir_read(struct dir_t* pdir, struct dir_entry_t* pentry){
     unsigned int element_number = 0;
     for (int i=0; i<pdir->volume->psuper->root_dir_capacity; i++){
         memcpy(pentry, root + i*SIZE_OF_DIRECTORY_ENTRY, SIZE_OF_DIRECTORY_ENTRY);
-        if (pentry->filename[0] == FAT_DELETED || pentry->filename[0] == (char)0x00){
+        if (pentry->filename[0] == FAT_DELETED || pentry->filename[0] == FAT_END_OF_DIRECTORY){
             continue;
         }
         fill_entry_structure(pentry);
@@ -503,3 +503,155 @@ int dir_close(struct dir_t* pdir){
     free(pdir);
     return 0;
 }
+
+struct deleted_scan_t* deleted_scan_open(struct volume_t* pvolume){
+    if (!pvolume){
+        errno = EFAULT;
+        return NULL;
+    }
+    lba_t data_offset = pvolume->data_cluster_2 - pvolume->volume_start;
+    if (pvolume->psuper->sectors_per_cluster == 0 || pvolume->bytes_per_cluster == 0 ||
+        pvolume->volume_size < data_offset){
+        errno = EINVAL;
+        return NULL;
+    }
+    struct deleted_scan_t* scan = malloc(sizeof(struct deleted_scan_t));
+    if (!scan){
+        errno = ENOMEM;
+        return NULL;
+    }
+    scan->volume = pvolume;
+    scan->position = 0;
+    // tablica FAT jest dopelniana zerami, wiec ograniczeniem jest liczba klastrow woluminu,
+    // a uszkodzony sektor rozruchowy moze podawac wiecej klastrow niz miesci sie w FAT
+    cluster_t fat_entries = (pvolume->psuper->sectors_per_fat * pvolume->psuper->bytes_per_sector) / sizeof(uint16_t);
+    scan->clusters_count = (pvolume->volume_size - data_offset) / pvolume->psuper->sectors_per_cluster + 2;
+    if (scan->clusters_count > fat_entries){
+        scan->clusters_count = fat_entries;
+    }
+
+    scan->root = malloc(pvolume->sectors_per_dir * pvolume->psuper->bytes_per_sector);
+    if (!scan->root){
+        errno = ENOMEM;
+        free(scan);
+        return NULL;
+    }
+    if (disk_read(pvolume->disk, pvolume->dir_position, scan->root, pvolume->sectors_per_dir) == -1){
+        free(scan->root);
+        free(scan);
+        return NULL;
+    }
+
+    scan->fat_table = get_fat_table(pvolume);
+    if (!scan->fat_table){
+        free(scan->root);
+        free(scan);
+        return NULL;
+    }
+
+    return scan;
+}
+
+static int rebuild_deleted_chain(struct deleted_scan_t* pscan, struct recovered_entry_t* recovered){
+    recovered->clusters = NULL;
+    recovered->clusters_number = 0;
+
+    cluster_t first_cluster = recovered->entry.low_cluster_index;
+    uint64_t bytes_per_cluster = pscan->volume->bytes_per_cluster;
+    uint64_t clusters_needed = ((uint64_t)recovered->entry.size + bytes_per_cluster - 1) / bytes_per_cluster;
+    // katalogi maja rozmiar 0, ale zajmuja co najmniej jeden klaster
+    if (recovered->entry.is_directory && clusters_needed == 0){
+        clusters_needed = 1;
+    }
+    if (clusters_needed == 0){
+        recovered->status = RECOVERY_NO_DATA;
+        return 0;
+    }
+    // klaster startowy zajety przez inny plik - dane zostaly nadpisane
+    if (first_cluster < 2 || first_cluster >= pscan->clusters_count ||
+        pscan->fat_table[first_cluster] != FAT_FREE_CLUSTER){
+        recovered->status = RECOVERY_OVERWRITTEN;
+        return 0;
+    }
+    // rozmiar z usunietego wpisu moze byc bledny, wiecej klastrow niz na woluminie nie istnieje
+    if (clusters_needed > pscan->clusters_count - first_cluster){
+        clusters_needed = pscan->clusters_count - first_cluster;
+    }
+
+    recovered->clusters = malloc((size_t)clusters_needed * sizeof(uint16_t));
+    if (!recovered->clusters){
+        errno = ENOMEM;
+        return -1;
+    }
+    // usuniete pliki zwykle zajmowaly kolejne wolne klastry od klastra startowego
+    for (cluster_t cluster = first_cluster; cluster < pscan->clusters_count &&
+         recovered->clusters_number < clusters_needed; cluster++){
+        if (pscan->fat_table[cluster] == FAT_FREE_CLUSTER){
+            recovered->clusters[recovered->clusters_number++] = cluster;
+        }
+    }
+    recovered->status = (uint64_t)recovered->clusters_number * bytes_per_cluster < recovered->entry.size ?
+                        RECOVERY_TRUNCATED : RECOVERY_COMPLETE;
+
+    return 0;
+}
+
+int deleted_scan_read(struct deleted_scan_t* pscan, struct recovered_entry_t* batch, size_t batch_size){
+    if (!pscan || !batch){
+        errno = EFAULT;
+        return -1;
+    }
+    size_t found = 0;
+    const uint8_t* root = pscan->root;
+    int capacity = pscan->volume->psuper->root_dir_capacity;
+    while (found < batch_size && pscan->position < capacity){
+        const uint8_t* slot = root + pscan->position * SIZE_OF_DIRECTORY_ENTRY;
+        // sprawdzany jest tylko pierwszy bajt wpisu, reszta dekodowana dopiero dla usunietych
+        if ((char)slot[0] == FAT_END_OF_DIRECTORY){
+            pscan->position = capacity;
+            break;
+        }
+        pscan->position++;
+        if ((char)slot[0] != FAT_DELETED || (slot[11] & FAT_ATTRIB_LONG_NAME) == FAT_ATTRIB_LONG_NAME){
+            continue;
+        }
+
+        struct recovered_entry_t* recovered = batch + found;
+        memcpy(&recovered->entry, slot, SIZE_OF_DIRECTORY_ENTRY);
+        fill_entry_structure(&recovered->entry);
+        if (recovered->entry.is_volume_label){
+            continue;
+        }
+        recovered->entry.name[0] = '_';
+        if (rebuild_deleted_chain(pscan, recovered) == -1){
+            // wpis zostanie ponownie odczytany w kolejnym wywolaniu, zebrane wpisy sa zwracane
+            pscan->position--;
+            return found > 0 ? (int)found : -1;
+        }
+        found++;
+    }
+
+    return (int)found;
+}
+
+void deleted_scan_release(struct recovered_entry_t* batch, size_t count){
+    if (!batch){
+        return;
+    }
+    for (size_t i=0; i<count; i++){
+        free(batch[i].clusters);
+        batch[i].clusters = NULL;
+        batch[i].clusters_number = 0;
+    }
+}
+
+int deleted_scan_close(struct deleted_scan_t* pscan){
+    if (!pscan){
+        errno = EFAULT;
+        return -1;
+    }
+    free(pscan->root);
+    free(pscan->fat_table);
+    free(pscan);
+    return 0;
+}
@@ -7,6 +7,8 @@
 #define SIZE_OF_FILENAME 8
 #define SIZE_OF_EXTENSION 3
 #define LAST_CLUSTER 0xfff8
+#define FAT_END_OF_DIRECTORY ((char)0x00)
+#define FAT_FREE_CLUSTER 0x0000
 
 #include <inttypes.h>
 #include <stdio.h>
@@ -26,6 +28,7 @@ enum attribs_t{
     FAT_ATTRIB_VOLUME_LABEL = 0x08,
     FAT_ATTRIB_DIRECTORY = 0x10,
     FAT_ATTRIB_ARCHIVE = 0x20,
+    FAT_ATTRIB_LONG_NAME = 0x0F,
 };
 
 struct disk_t{
@@ -117,6 +120,28 @@ struct dir_t{
     unsigned int founded_elements;
 };
 
+enum recovery_status_t{
+    RECOVERY_COMPLETE = 0, // odtworzono tyle klastrow, ile wynika z rozmiaru pliku
+    RECOVERY_TRUNCATED = 1, // zabraklo wolnych klastrow, lancuch krotszy niz rozmiar pliku
+    RECOVERY_OVERWRITTEN = 2, // klaster startowy zajety lub poza woluminem, brak lancucha
+    RECOVERY_NO_DATA = 3, // plik o rozmiarze 0, brak lancucha
+};
+
+struct recovered_entry_t{
+    struct dir_entry_t entry; // name[0] zamieniony na '_'
+    uint16_t *clusters; // odtworzony lancuch klastrow, zwalniany przez deleted_scan_release
+    size_t clusters_number;
+    enum recovery_status_t status;
+};
+
+struct deleted_scan_t{
+    struct volume_t* volume;
+    uint8_t* root;
+    uint16_t* fat_table;
+    cluster_t clusters_count; // liczba klastrow woluminu + 2 zarezerwowane, nie wiecej niz wpisow w FAT
+    int position;
+};
+
 void get_chain_fat16(struct file_t* file, const void* const buffer,
                      uint16_t first_cluster);
 
@@ -141,4 +166,9 @@ struct dir_t* dir_open(struct volume_t* pvolume, const char* dir_path);
 int dir_read(struct dir_t* pdir, struct dir_entry_t* pentry);
 int dir_close(struct dir_t* pdir);
 
+struct deleted_scan_t* deleted_scan_open(struct volume_t* pvolume);
+int deleted_scan_read(struct deleted_scan_t* pscan, struct recovered_entry_t* batch, size_t batch_size);
+void deleted_scan_release(struct recovered_entry_t* batch, size_t count);
+int deleted_scan_close(struct deleted_scan_t* pscan);
+
 #endif
\ No newline at end of file
@@ -7,6 +7,9 @@ int main() {
     dir_open(NULL, NULL);
     dir_read(NULL, NULL);
     dir_close(NULL);
+    deleted_scan_open(NULL);
+    deleted_scan_read(NULL, NULL, 0);
+    deleted_scan_close(NULL);
     fat_open(NULL, 0);
     disk_open_from_file(NULL);
     disk_close(NULL);